@@ -171,6 +171,52 @@ void cbor_variant::encode_onto(std::vector<uint8_t>* in) const
     }
 }
 
+// find the value at the end of the path and replace it with this variant
+void cbor_variant::encode_over(std::vector<uint8_t>* in, const std::vector<std::string>& path) const
+{
+    // walk down through the maps without decoding anything we don't need to
+    unsigned int offset=0;
+    for (auto& key : path) {
+        const header* h=header_at(*in, offset);
+        while (h->major==6) {  // tags (are ignored)
+            read_integer_header(*in, h, &offset);
+            h=header_at(*in, offset);
+        }
+        if (h->major!=5) throw runtime_error("Asked to follow a key through something that is not a map");
+        bool found=false;
+        for (int pending_items=read_integer_header(*in, h, &offset); pending_items>0; pending_items--) {
+            // compare the key in place
+            h=header_at(*in, offset);
+            if (h->major!=3) throw runtime_error("Asked to process a map entry whose key is not a string");
+            int key_length=read_integer_header(*in, h, &offset);
+            if (key_length<0) throw runtime_error("Length of a (map) key was expressed as a negative number");
+            if (in->size()<offset+static_cast<unsigned int>(key_length)) throw length_error("Insufficient key bytes while decoding cbor");
+            found=key.compare(0, string::npos, reinterpret_cast<const char*>(in->data()+offset), static_cast<size_t>(key_length))==0;
+            offset+=static_cast<unsigned int>(key_length);
+            if (found) break;
+
+            // not this one
+            skip_over(*in, &offset);
+        }
+        if (!found) throw out_of_range("Key not found while following a path through cbor: "+key);
+    }
+
+    // encode the replacement and find the extent of the value it's replacing
+    vector<uint8_t> replacement;
+    encode_onto(&replacement);
+    unsigned int value_begin=offset;
+    skip_over(*in, &offset);
+    size_t old_length=offset-value_begin;
+
+    // make room (or take it away) then overwrite
+    // containers count items not bytes, so none of the enclosing headers need to change
+    if (replacement.size()>old_length)
+        in->insert(in->begin()+offset, replacement.size()-old_length, 0);
+    else if (replacement.size()<old_length)
+        in->erase(in->begin()+value_begin+static_cast<long>(replacement.size()), in->begin()+offset);
+    copy(replacement.begin(), replacement.end(), in->begin()+value_begin);
+}
+
 string cbor_variant::as_python() const
 {
     switch (index()) {
@@ -251,6 +297,64 @@ int cbor_variant::read_integer_header(const std::vector<uint8_t>& in, const head
     }
 }
 
+const cbor_variant::header* cbor_variant::header_at(const std::vector<uint8_t>& in, unsigned int offset)
+{
+    if (in.size()<=offset) throw length_error("No header byte while decoding cbor");
+    return reinterpret_cast<const header*>(&in[offset]);
+}
+
+// move the offset past one variant without constructing it
+void cbor_variant::skip_over(const std::vector<uint8_t>& in, unsigned int* offset)
+{
+    const header* h=header_at(in, *offset);
+    switch (h->major) {
+        case 0:  // integers
+        case 1:
+            read_integer_header(in, h, offset);
+            return;
+
+        case 2:  // bytes and strings
+        case 3: {
+            int length=read_integer_header(in, h, offset);
+            if (length<0) throw runtime_error("A negative length was given for a byte array or string");
+            *offset+=static_cast<unsigned int>(length);
+            if (in.size()<*offset) throw length_error("Insufficient data bytes while decoding cbor");
+            return;
+        }
+
+        case 4: {  // arrays
+            for (int pending_items=read_integer_header(in, h, offset); pending_items>0; pending_items--)
+                skip_over(in, offset);
+            return;
+        }
+
+        case 5: {  // maps (key then value)
+            for (int pending_items=read_integer_header(in, h, offset); pending_items>0; pending_items--) {
+                skip_over(in, offset);
+                skip_over(in, offset);
+            }
+            return;
+        }
+
+        case 6: {  // tags
+            read_integer_header(in, h, offset);
+            skip_over(in, offset);
+            return;
+        }
+
+        case 7: {  // floats and none
+            unsigned int length;
+            if (h->additional==26) length=5;
+            else if (h->additional==27) length=9;
+            else if (h->additional==22) length=1;
+            else throw runtime_error("Asked to process a major type 7 that is neither a float nor a double");
+            *offset+=length;
+            if (in.size()<*offset) throw length_error("Insufficient data bytes while decoding cbor");
+            return;
+        }
+    }
+}
+
 void cbor_variant::float_to_big_endian(const uint8_t* p_src, uint8_t* p_dest)
 {
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
@@ -39,6 +39,10 @@ struct cbor_variant : cbor_baseclass
     // encode this variant onto the end of the passed vector
     void encode_onto(std::vector<uint8_t>* in) const;
 
+    // encode this variant over the value found by following a path of map keys through the passed vector
+    // (the rest of the buffer is left encoded - it's only moved if the new encoding is a different length)
+    void encode_over(std::vector<uint8_t>* in, const std::vector<std::string>& path) const;
+
     // describe this variant using a Python compatible format
     std::string as_python() const;
 
@@ -84,6 +88,8 @@ private:
     static unsigned int integer_length(int additional);
     static void append_integer_header(unsigned int major, unsigned int val, std::vector<uint8_t>* in);
     static int read_integer_header(const std::vector<uint8_t>& in, const header* h, unsigned int* offset);
+    static const header* header_at(const std::vector<uint8_t>& in, unsigned int offset);
+    static void skip_over(const std::vector<uint8_t>& in, unsigned int* offset);
     static void float_to_big_endian(const uint8_t* p_src, uint8_t* p_dest);
     static void double_to_big_endian(const uint8_t* p_src, uint8_t* p_dest);
 };
@@ -166,6 +166,48 @@ void CborTest::describe()
     CPPUNIT_ASSERT_EQUAL(empty_map.as_python(), string("{}"));
 }
 
+void CborTest::patch()
+{
+    // Same length
+    this->scratchpad.clear();
+    this->m.encode_onto(&this->scratchpad);
+    size_t original_size=this->scratchpad.size();
+    cbor_variant { 2 }.encode_over(&this->scratchpad, {"Aye"});
+    CPPUNIT_ASSERT_EQUAL(this->scratchpad.size(), original_size);
+    CPPUNIT_ASSERT_EQUAL(cbor_variant::construct_from(this->scratchpad).as_python(),
+                         string("{\"Aye\": 2, \"Eff\": 1.100000, \"Eh\": [1, 1.100000, \"Hello World!\"]}"));
+
+    // Longer, then shorter again
+    cbor_variant { 12345678 }.encode_over(&this->scratchpad, {"Aye"});
+    CPPUNIT_ASSERT_EQUAL(this->scratchpad.size(), original_size+4);
+    CPPUNIT_ASSERT_EQUAL(get<int>(get<cbor_map>(cbor_variant::construct_from(this->scratchpad))["Aye"]), 12345678);
+    this->n.encode_over(&this->scratchpad, {"Eff"});
+    CPPUNIT_ASSERT_EQUAL(cbor_variant::construct_from(this->scratchpad).as_python(),
+                         string("{\"Aye\": 12345678, \"Eff\": None, \"Eh\": [1, 1.100000, \"Hello World!\"]}"));
+
+    // Nested, including the value at the very end of the buffer
+    cbor_variant outer { cbor_map {
+                        {std::string("inner"), this->m},
+                        {std::string("last"), this->i}}};
+    this->scratchpad.clear();
+    outer.encode_onto(&this->scratchpad);
+    this->s.encode_over(&this->scratchpad, {"inner", "Eff"});
+    this->b.encode_over(&this->scratchpad, {"last"});
+    CPPUNIT_ASSERT_EQUAL(cbor_variant::construct_from(this->scratchpad).as_python(),
+                         string("{\"inner\": {\"Aye\": 1, \"Eff\": \"Hello World!\", \"Eh\": [1, 1.100000, \"Hello World!\"]}, "
+                                "\"last\": bytes([0x62, 0x79, 0x74, 0x65, 0x73])}"));
+
+    // Replacing the whole thing with an empty path
+    this->i.encode_over(&this->scratchpad, {});
+    CPPUNIT_ASSERT_EQUAL(this->scratchpad.size(), static_cast<size_t>(1));
+
+    // Bad paths
+    this->scratchpad.clear();
+    this->m.encode_onto(&this->scratchpad);
+    CPPUNIT_ASSERT_THROW(this->i.encode_over(&this->scratchpad, {"Bee"}), std::out_of_range);
+    CPPUNIT_ASSERT_THROW(this->i.encode_over(&this->scratchpad, {"Eh", "Aye"}), std::runtime_error);
+}
+
 int main(int argc, char* argv[])
 {
     CppUnit::Test* suite = CppUnit::TestFactoryRegistry::getRegistry().makeTest();
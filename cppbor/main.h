@@ -29,6 +29,7 @@ public:
     CPPUNIT_TEST( roundTrip );
     CPPUNIT_TEST( pythonCompat );
     CPPUNIT_TEST( describe );
+    CPPUNIT_TEST( patch );
     CPPUNIT_TEST_SUITE_END();
 
     void testGet();
@@ -38,6 +39,7 @@ public:
     void roundTrip();
     void pythonCompat();
     void describe();
+    void patch();
 
 private:
     cbor_variant i { 1 };